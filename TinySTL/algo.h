@@ -0,0 +1,242 @@
+//
+// 包含一些基本的算法
+// 包括 iter_swap, reverse, rotate 等函数
+//
+#ifndef TINYSTL_ALGO_H
+#define TINYSTL_ALGO_H
+
+#include <cstddef>
+#include <cstring>
+
+#include "type_traits.h"
+#include "iterator.h"
+#include "util.h"
+
+namespace mystl {
+    // iter_swap 函数
+    // 交换两个迭代器所指的对象
+    template <class FIter1, class FIter2>
+    void iter_swap(FIter1 lhs, FIter2 rhs) {
+        mystl::swap(*lhs, *rhs);
+    }
+
+    /* 以下函数用于将 [first, last) 区间内的元素反转 */
+    // bidirectional_iterator_tag 的 reverse
+    template <class BidirectionalIter>
+    void reverse_dispatch(BidirectionalIter first, BidirectionalIter last, bidirectional_iterator_tag) {
+        while (true) {
+            if (first == last || first == --last) {
+                return;
+            }
+            mystl::iter_swap(first++, last);
+        }
+    }
+
+    // random_access_iterator_tag 的 reverse
+    template <class RandomIter>
+    void reverse_dispatch(RandomIter first, RandomIter last, random_access_iterator_tag) {
+        if (first == last) {
+            return;
+        }
+        --last;
+        while (first < last) {
+            mystl::iter_swap(first++, last--);
+        }
+    }
+
+    // reverse 接口
+    template <class BidirectionalIter>
+    void reverse(BidirectionalIter first, BidirectionalIter last) {
+        mystl::reverse_dispatch(first, last, iterator_category(first));
+    }
+
+    /* 以下函数用于将 [first, middle) 与 [middle, last) 两段互换，返回原 first 所指元素的新位置 */
+    // forward_iterator_tag 的 rotate
+    // 前向迭代器无法反转，反复把前段与后段等长的块交换
+    template <class ForwardIter>
+    ForwardIter rotate_dispatch(ForwardIter first, ForwardIter middle, ForwardIter last, forward_iterator_tag) {
+        auto first2 = middle;
+        do {
+            mystl::iter_swap(first++, first2++);
+            if (first == middle) {
+                middle = first2;
+            }
+        } while (first2 != last);
+
+        auto result = first;
+        first2 = middle;
+        while (first2 != last) {
+            mystl::iter_swap(first++, first2++);
+            if (first == middle) {
+                middle = first2;
+            } else if (first2 == last) {
+                first2 = middle;
+            }
+        }
+        return result;
+    }
+
+    // bidirectional_iterator_tag 的 rotate
+    // 分别反转两段，再整体反转，整体反转在两端相遇处停下以确定返回值
+    template <class BidirectionalIter>
+    BidirectionalIter rotate_dispatch(BidirectionalIter first, BidirectionalIter middle,
+                                      BidirectionalIter last, bidirectional_iterator_tag) {
+        mystl::reverse_dispatch(first, middle, bidirectional_iterator_tag());
+        mystl::reverse_dispatch(middle, last, bidirectional_iterator_tag());
+        while (first != middle && middle != last) {
+            mystl::iter_swap(first++, --last);
+        }
+        if (first == middle) {
+            mystl::reverse_dispatch(middle, last, bidirectional_iterator_tag());
+            return last;
+        } else {
+            mystl::reverse_dispatch(first, middle, bidirectional_iterator_tag());
+            return first;
+        }
+    }
+
+    // 求最大公因子
+    template <class EuclideanRingElement>
+    EuclideanRingElement rgcd(EuclideanRingElement m, EuclideanRingElement n) {
+        while (n != 0) {
+            EuclideanRingElement t = m % n;
+            m = n;
+            n = t;
+        }
+        return m;
+    }
+
+    // Gries-Mills 中较短一段不超过该字节数时，改用缓冲区一次完成
+    constexpr size_t rotate_buffer_size = 256;
+
+    // 缓冲区能容纳的元素个数，至少为 1
+    template <class Tp>
+    constexpr size_t rotate_buffer_count() {
+        return sizeof(Tp) < rotate_buffer_size ? rotate_buffer_size / sizeof(Tp) : 1;
+    }
+
+    // 较短一段先存入缓冲区，较长一段整体平移，再把缓冲区放回
+    // 调用者保证较短一段不超过 rotate_buffer_count 个元素
+    template <class RandomIter>
+    void rotate_buffer_aux(RandomIter first, RandomIter middle, RandomIter last) {
+        typedef typename iterator_traits<RandomIter>::value_type      value_type;
+        typedef typename iterator_traits<RandomIter>::difference_type difference_type;
+        const size_t sz = sizeof(value_type);
+        unsigned char buf[rotate_buffer_count<value_type>() * sizeof(value_type)];
+        const auto i = middle - first;
+        const auto j = last - middle;
+        if (i <= j) {
+            for (difference_type k = 0; k < i; ++k) {
+                std::memcpy(buf + k * sz, &*(first + k), sz);
+            }
+            for (; middle != last; ++first, (void) ++middle) {
+                *first = *middle;
+            }
+            for (difference_type k = 0; k < i; ++k) {
+                std::memcpy(&*(first + k), buf + k * sz, sz);
+            }
+        } else {
+            for (difference_type k = 0; k < j; ++k) {
+                std::memcpy(buf + k * sz, &*(middle + k), sz);
+            }
+            while (middle != first) {
+                *--last = *--middle;
+            }
+            for (difference_type k = 0; k < j; ++k) {
+                std::memcpy(&*(first + k), buf + k * sz, sz);
+            }
+        }
+    }
+
+    // 原生指针的重载，较长一段用 memmove 平移
+    template <class Tp>
+    void rotate_buffer_aux(Tp* first, Tp* middle, Tp* last) {
+        unsigned char buf[rotate_buffer_count<Tp>() * sizeof(Tp)];
+        const size_t i = static_cast<size_t>(middle - first);
+        const size_t j = static_cast<size_t>(last - middle);
+        if (i <= j) {
+            std::memcpy(buf, first, i * sizeof(Tp));
+            std::memmove(first, middle, j * sizeof(Tp));
+            std::memcpy(first + j, buf, i * sizeof(Tp));
+        } else {
+            std::memcpy(buf, middle, j * sizeof(Tp));
+            std::memmove(first + j, first, i * sizeof(Tp));
+            std::memcpy(first, buf, j * sizeof(Tp));
+        }
+    }
+
+    // 可平凡复制的类型使用 Gries-Mills 块交换，每一步都是一次 swap_range，
+    // 连续区间上会走分块交换的快速路径；
+    // 较短一段落入缓冲区后改用 rotate_buffer_aux，避免逐个元素的交换
+    template <class RandomIter>
+    RandomIter rotate_random_aux(RandomIter first, RandomIter middle, RandomIter last, std::true_type) {
+        typedef typename iterator_traits<RandomIter>::value_type      value_type;
+        typedef typename iterator_traits<RandomIter>::difference_type difference_type;
+        const auto cap = static_cast<difference_type>(rotate_buffer_count<value_type>());
+        auto result = first + (last - middle);
+        auto i = middle - first;
+        auto j = last - middle;
+        while (i != j) {
+            if (i <= cap || j <= cap) {
+                mystl::rotate_buffer_aux(middle - i, middle, middle + j);
+                return result;
+            }
+            if (i > j) {
+                mystl::swap_range(middle - i, middle - i + j, middle);
+                i -= j;
+            } else {
+                mystl::swap_range(middle - i, middle, middle + j - i);
+                j -= i;
+            }
+        }
+        mystl::swap_range(middle - i, middle, middle);
+        return result;
+    }
+
+    // 其余类型使用 juggling 算法，沿 gcd(n, k) 个环移动，每个元素只移动一次
+    template <class RandomIter>
+    RandomIter rotate_random_aux(RandomIter first, RandomIter middle, RandomIter last, std::false_type) {
+        auto n = last - first;
+        auto k = middle - first;
+        auto cycles = mystl::rgcd(n, k);
+        for (decltype(n) c = 0; c < cycles; ++c) {
+            auto tmp = mystl::move(*(first + c));
+            auto p = c;
+            while (true) {
+                auto q = p + k;
+                if (q >= n) {
+                    q -= n;
+                }
+                if (q == c) {
+                    break;
+                }
+                *(first + p) = mystl::move(*(first + q));
+                p = q;
+            }
+            *(first + p) = mystl::move(tmp);
+        }
+        return first + (n - k);
+    }
+
+    // random_access_iterator_tag 的 rotate
+    template <class RandomIter>
+    RandomIter rotate_dispatch(RandomIter first, RandomIter middle, RandomIter last, random_access_iterator_tag) {
+        typedef typename iterator_traits<RandomIter>::value_type value_type;
+        return mystl::rotate_random_aux(first, middle, last,
+                                        typename std::is_trivially_copyable<value_type>::type{});
+    }
+
+    // rotate 接口
+    template <class ForwardIter>
+    ForwardIter rotate(ForwardIter first, ForwardIter middle, ForwardIter last) {
+        if (first == middle) {
+            return last;
+        }
+        if (middle == last) {
+            return first;
+        }
+        return mystl::rotate_dispatch(first, middle, last, iterator_category(first));
+    }
+} // namespace mystl
+
+#endif //TINYSTL_ALGO_H
@@ -0,0 +1,216 @@
+//
+// 包含哈希函数对象
+// 包括 hash, hash_bytes, hash_batch 等
+//
+#ifndef TINYSTL_FUNCTIONAL_H
+#define TINYSTL_FUNCTIONAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "type_traits.h"
+#include "iterator.h"
+#include "util.h"
+
+namespace mystl {
+    /* 以下为 wyhash 使用的常量与基本运算 */
+    constexpr uint64_t hash_secret0 = 0xa0761d6478bd642full;
+    constexpr uint64_t hash_secret1 = 0xe7037ed1a0b428dbull;
+    constexpr uint64_t hash_secret2 = 0x8ebc6af09c88c6e3ull;
+    constexpr uint64_t hash_secret3 = 0x589965cc75374cc3ull;
+
+    // 64 位乘法得到 128 位结果，低 64 位存入 a，高 64 位存入 b
+    inline void hash_mum(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t r = a;
+        r *= b;
+        a = static_cast<uint64_t>(r);
+        b = static_cast<uint64_t>(r >> 64);
+#else
+        const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+        const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        const uint64_t t = rl + (rm0 << 32);
+        uint64_t c = t < rl;
+        const uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        a = lo;
+        b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+    }
+
+    // 乘法后将高低两半异或折叠
+    inline uint64_t hash_mix(uint64_t a, uint64_t b) {
+        hash_mum(a, b);
+        return a ^ b;
+    }
+
+    // 按小端方式读取 8 / 4 字节，memcpy 避免未对齐访问，大端机器上需要交换字节序
+    inline uint64_t hash_read8(const unsigned char* p) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap64(v);
+#endif
+        return v;
+    }
+
+    inline uint64_t hash_read4(const unsigned char* p) {
+        uint32_t v;
+        std::memcpy(&v, p, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap32(v);
+#endif
+        return v;
+    }
+
+    // 读取 1 ~ 3 个字节
+    inline uint64_t hash_read3(const unsigned char* p, size_t k) {
+        return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+    }
+
+    // hash_bytes 函数
+    // 对一段字节使用 wyhash 计算哈希值，短串只需一到两次乘法，长串每轮并行处理 48 字节
+    inline size_t hash_bytes(const void* key, size_t len, uint64_t seed = 0) {
+        auto p = static_cast<const unsigned char*>(key);
+        seed ^= hash_mix(seed ^ hash_secret0, hash_secret1);
+        uint64_t a, b;
+        if (len <= 16) {
+            if (len >= 4) {
+                a = (hash_read4(p) << 32) | hash_read4(p + ((len >> 3) << 2));
+                b = (hash_read4(p + len - 4) << 32) | hash_read4(p + len - 4 - ((len >> 3) << 2));
+            } else if (len > 0) {
+                a = hash_read3(p, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t i = len;
+            if (i > 48) {
+                uint64_t see1 = seed, see2 = seed;
+                do {
+                    seed = hash_mix(hash_read8(p) ^ hash_secret1, hash_read8(p + 8) ^ seed);
+                    see1 = hash_mix(hash_read8(p + 16) ^ hash_secret2, hash_read8(p + 24) ^ see1);
+                    see2 = hash_mix(hash_read8(p + 32) ^ hash_secret3, hash_read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16) {
+                seed = hash_mix(hash_read8(p) ^ hash_secret1, hash_read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = hash_read8(p + i - 16);
+            b = hash_read8(p + i - 8);
+        }
+        a ^= hash_secret1;
+        b ^= seed;
+        hash_mum(a, b);
+        return static_cast<size_t>(hash_mix(a ^ hash_secret0 ^ len, b ^ hash_secret1));
+    }
+
+    // hash_int 函数
+    // 整数只做一次乘法折叠
+    inline size_t hash_int(uint64_t x) {
+        return static_cast<size_t>(hash_mix(x ^ hash_secret0, hash_secret1));
+    }
+
+    // hash_combine 函数
+    // 将两个哈希值合并，结果与顺序有关
+    inline size_t hash_combine(size_t lhs, size_t rhs) {
+        return static_cast<size_t>(hash_mix(static_cast<uint64_t>(lhs) ^ hash_secret2,
+                                            static_cast<uint64_t>(rhs) ^ hash_secret3));
+    }
+
+    // 模板类 hash
+    // 对于大部分类型，hash 什么都不做
+    template <class Key>
+    struct hash {};
+
+    // 针对指针的偏特化版本
+    template <class T>
+    struct hash<T*> {
+        size_t operator()(T* p) const noexcept {
+            return hash_int(reinterpret_cast<uintptr_t>(p));
+        }
+    };
+
+    // 对于整型类型，经过 hash_int 混合
+    #define MYSTL_INT_HASH_FCN(Type)                            \
+    template <> struct hash<Type> {                             \
+        size_t operator()(Type val) const noexcept {            \
+            return hash_int(static_cast<uint64_t>(val));        \
+        }                                                       \
+    };
+
+    MYSTL_INT_HASH_FCN(bool)
+    MYSTL_INT_HASH_FCN(char)
+    MYSTL_INT_HASH_FCN(signed char)
+    MYSTL_INT_HASH_FCN(unsigned char)
+    MYSTL_INT_HASH_FCN(wchar_t)
+    MYSTL_INT_HASH_FCN(char16_t)
+    MYSTL_INT_HASH_FCN(char32_t)
+    MYSTL_INT_HASH_FCN(short)
+    MYSTL_INT_HASH_FCN(unsigned short)
+    MYSTL_INT_HASH_FCN(int)
+    MYSTL_INT_HASH_FCN(unsigned int)
+    MYSTL_INT_HASH_FCN(long)
+    MYSTL_INT_HASH_FCN(unsigned long)
+    MYSTL_INT_HASH_FCN(long long)
+    MYSTL_INT_HASH_FCN(unsigned long long)
+
+    #undef MYSTL_INT_HASH_FCN
+
+    // 对于浮点数，逐字节哈希，+0.0 与 -0.0 视为相同
+    #define MYSTL_FLOAT_HASH_FCN(Type)                                          \
+    template <> struct hash<Type> {                                             \
+        size_t operator()(const Type& val) const noexcept {                     \
+            return val == 0.0f ? hash_bytes(nullptr, 0) : hash_bytes(&val, sizeof(Type)); \
+        }                                                                       \
+    };
+
+    MYSTL_FLOAT_HASH_FCN(float)
+    MYSTL_FLOAT_HASH_FCN(double)
+
+    #undef MYSTL_FLOAT_HASH_FCN
+
+    // 对于字节串，使用 hash_bytes
+    template <>
+    struct hash<std::string> {
+        size_t operator()(const std::string& str) const noexcept {
+            return hash_bytes(str.data(), str.size());
+        }
+    };
+
+    // 针对 pair 的偏特化版本，合并两个成员的哈希值
+    template <class Ty1, class Ty2>
+    struct hash<mystl::pair<Ty1, Ty2>> {
+        size_t operator()(const mystl::pair<Ty1, Ty2>& p) const {
+            typedef typename std::remove_cv<Ty1>::type first_type;
+            typedef typename std::remove_cv<Ty2>::type second_type;
+            return hash_combine(hash<first_type>()(p.first), hash<second_type>()(p.second));
+        }
+    };
+
+    // hash_batch 函数
+    // 依次计算 [first, last) 内每个键的哈希值并写入 result
+    template <class InputIter, class OutputIter, class Hash>
+    OutputIter hash_batch(InputIter first, InputIter last, OutputIter result, Hash hf) {
+        for (; first != last; ++first, (void) ++result) {
+            *result = hf(*first);
+        }
+        return result;
+    }
+
+    template <class InputIter, class OutputIter>
+    OutputIter hash_batch(InputIter first, InputIter last, OutputIter result) {
+        typedef typename iterator_traits<InputIter>::value_type value_type;
+        return mystl::hash_batch(first, last, result, hash<value_type>());
+    }
+} // namespace mystl
+
+#endif //TINYSTL_FUNCTIONAL_H
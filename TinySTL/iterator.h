@@ -44,7 +44,7 @@ namespace mystl {
         static two test(...);
 
         template <class U>
-        static char test(typename U::iterator_categorly* = 0);
+        static char test(typename U::iterator_category* = 0);
 
     public:
         static const bool value = sizeof(test<T>(0)) == sizeof(char);
@@ -69,7 +69,7 @@ namespace mystl {
     // iterator_traits 的偏特化
     template <class Iterator>
     struct iterator_traits_helper<Iterator, true>
-            : public iterator_traits_helper<Iterator,
+            : public iterator_traits_impl<Iterator,
             std::is_convertible<typename Iterator::iterator_category, input_iterator_tag>::value ||
             std::is_convertible<typename Iterator::iterator_category, output_iterator_tag>::value> {};
 
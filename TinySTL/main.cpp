@@ -1,11 +1,128 @@
 #include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <string>
 #include "iterator.h"
 #include "construct.h"
 #include "util.h"
+#include "algo.h"
+#include "functional.h"
 
 using std::cout;
 using std::endl;
+
+static int failures = 0;
+
+// 检查条件，不满足时输出信息
+static void check(bool cond, const char* what) {
+    if (!cond) {
+        cout << "FAILED: " << what << endl;
+        ++failures;
+    }
+}
+
+// rotate 与逐个计算的结果比较，覆盖两段长度悬殊的情况
+template <class T, class Gen>
+static void check_rotate(int n, int k, Gen gen) {
+    T* a = new T[n];
+    T* expect = new T[n];
+    for (int i = 0; i < n; ++i) {
+        a[i] = gen(i);
+    }
+    for (int i = 0; i < n; ++i) {
+        expect[i] = a[(i + k) % n];
+    }
+    T* r = mystl::rotate(a, a + k, a + n);
+    bool ok = r == a + (n - k);
+    for (int i = 0; i < n; ++i) {
+        ok = ok && a[i] == expect[i];
+    }
+    check(ok, "rotate");
+    delete[] a;
+    delete[] expect;
+}
+
+static int gen_int(int i) {
+    return i * 7 + 1;
+}
+
+static std::string gen_string(int i) {
+    return std::to_string(i);
+}
+
+static void test_algo() {
+    const int n = 1000;
+    const int ks[] = {0, 1, 2, 3, 63, 64, 65, 333, 334, 500, 667, 936, 998, 999, 1000};
+    for (int k : ks) {
+        check_rotate<int>(n, k, gen_int);
+        check_rotate<std::string>(n, k, gen_string);
+    }
+
+    int a[n];
+    for (int i = 0; i < n; ++i) {
+        a[i] = i;
+    }
+    mystl::reverse(a, a + n);
+    bool ok = true;
+    for (int i = 0; i < n; ++i) {
+        ok = ok && a[i] == n - 1 - i;
+    }
+    check(ok, "reverse");
+
+    int x[37], y[37];
+    for (int i = 0; i < 37; ++i) {
+        x[i] = i;
+        y[i] = -i;
+    }
+    mystl::swap(x, y);
+    ok = true;
+    for (int i = 0; i < 37; ++i) {
+        ok = ok && x[i] == -i && y[i] == i;
+    }
+    check(ok, "array swap");
+}
+
+static void test_functional() {
+    // wyhash 的参考值，种子取下标
+    const char* msgs[] = {
+        "", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+    };
+    const uint64_t expect[] = {
+        0x0409638ee2bde459ull, 0xa8412d091b5fe0a9ull, 0x32dd92e4b2915153ull, 0x8619124089a3a16bull,
+        0x7a43afb61d7f5f40ull, 0xff42329b90e50d58ull, 0xc39cab13b115aad3ull
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(msgs) / sizeof(msgs[0]); ++i) {
+        ok = ok && static_cast<uint64_t>(mystl::hash_bytes(msgs[i], std::strlen(msgs[i]), i)) == expect[i];
+    }
+    check(ok, "hash_bytes reference vectors");
+
+    check(mystl::hash<double>()(0.0) == mystl::hash<double>()(-0.0), "hash<double> of +0.0 and -0.0");
+
+    mystl::pair<const int, int> p(1, 2), q(2, 1);
+    mystl::hash<mystl::pair<const int, int>> hp;
+    check(hp(p) != hp(q), "hash<pair<const int, int>>");
+
+    std::string keys[37];
+    size_t hashes[37];
+    for (int i = 0; i < 37; ++i) {
+        keys[i] = std::to_string(i * 131);
+    }
+    size_t* end = mystl::hash_batch(keys, keys + 37, hashes);
+    ok = end == hashes + 37;
+    for (int i = 0; i < 37; ++i) {
+        ok = ok && hashes[i] == mystl::hash<std::string>()(keys[i]);
+    }
+    check(ok, "hash_batch");
+}
+
 int main(){
-    cout << "Hello, world!" << endl;
-    return 0;
+    test_algo();
+    test_functional();
+    if (failures == 0) {
+        cout << "All checks passed" << endl;
+    }
+    return failures == 0 ? 0 : 1;
 }
@@ -1,12 +1,13 @@
 //
 // 包含一些通用的工具
-// 包括 move, forward, swap 等函数，以及 pair
+// 包括 move, forward, swap, swap_range 等函数，以及 pair
 //
 
 #ifndef TINYSTL_UTIL_H
 #define TINYSTL_UTIL_H
 
 #include <cstddef>
+#include <cstring>
 #include "type_traits.h"
 
 namespace mystl {
@@ -33,17 +34,60 @@ namespace mystl {
     void swap(Tp& lhs, Tp& rhs) {
         auto tmp(mystl::move(lhs));
         lhs = mystl::move(rhs);
-        rhs = mystl::move(lhs);
+        rhs = mystl::move(tmp);
     }
 
+    // swap_range 函数
+    // 交换 [first1, last1) 与从 first2 开始的等长区间，两区间不能重叠
+    // 分块交换时每块的字节数
+    constexpr size_t swap_block_size = 64;
+
+    // 一般的迭代器，逐个元素交换
     template <class ForwardIter1, class ForwardIter2>
-    ForwardIter2 swap_range(ForwardIter1 first1, ForwardIter1 last1, ForwardIter2 first2) {
+    ForwardIter2 swap_range_aux(ForwardIter1 first1, ForwardIter1 last1, ForwardIter2 first2, std::false_type) {
         for (; first1 != last1; ++first1, (void) ++first2) {
             mystl::swap(*first1, *first2);
         }
         return first2;
     }
 
+    // 可平凡复制类型的连续区间，借助缓冲区按块交换，
+    // 定长的 memcpy 会被编译器展开为 SIMD 的加载与存储
+    template <class Tp>
+    Tp* swap_range_aux(Tp* first1, Tp* last1, Tp* first2, std::true_type) {
+        const size_t n = static_cast<size_t>(last1 - first1);
+        const size_t bytes = n * sizeof(Tp);
+        auto p1 = reinterpret_cast<unsigned char*>(first1);
+        auto p2 = reinterpret_cast<unsigned char*>(first2);
+        unsigned char buf[swap_block_size];
+        size_t i = 0;
+        for (; i + swap_block_size <= bytes; i += swap_block_size) {
+            std::memcpy(buf, p1 + i, swap_block_size);
+            std::memcpy(p1 + i, p2 + i, swap_block_size);
+            std::memcpy(p2 + i, buf, swap_block_size);
+        }
+        // 剩余不足一块的部分
+        if (i < bytes) {
+            const size_t rest = bytes - i;
+            std::memcpy(buf, p1 + i, rest);
+            std::memcpy(p1 + i, p2 + i, rest);
+            std::memcpy(p2 + i, buf, rest);
+        }
+        return first2 + n;
+    }
+
+    template <class ForwardIter1, class ForwardIter2>
+    ForwardIter2 swap_range(ForwardIter1 first1, ForwardIter1 last1, ForwardIter2 first2) {
+        return mystl::swap_range_aux(first1, last1, first2, std::false_type{});
+    }
+
+    // 原生指针的重载，std::is_trivially_copyable: 检查类型是否可平凡复制
+    template <class Tp>
+    Tp* swap_range(Tp* first1, Tp* last1, Tp* first2) {
+        return mystl::swap_range_aux(first1, last1, first2,
+                                     typename std::is_trivially_copyable<Tp>::type{});
+    }
+
     template <class Tp, size_t N>
     void swap(Tp(&a)[N], Tp(&b)[N]) {
         mystl::swap_range(a, a+N, b);